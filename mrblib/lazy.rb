@@ -0,0 +1,111 @@
+# Deferred vector arithmetic. Operators record an expression tree instead of
+# computing intermediates; `value` evaluates the whole tree in one pass,
+# accumulating into a single result vector with the in-place `!` methods.
+# Leaves may be arrays of vectors (or numerics), in which case the tree is
+# evaluated element-wise and an array is returned. A node used more than once
+# in the tree is only evaluated once per element.
+class LazyVec
+  OPS = { add: :add!, sub: :sub!, mul: :mul!, div: :div! }
+
+  attr_reader :op, :lhs, :rhs
+
+  def initialize(op, lhs, rhs = nil)
+    @op = op
+    @lhs = lhs
+    @rhs = rhs
+  end
+
+  def add(other) = LazyVec.new(:add, self, LazyVec.wrap(other))
+
+  def sub(other) = LazyVec.new(:sub, self, LazyVec.wrap(other))
+
+  def mul(other) = LazyVec.new(:mul, self, LazyVec.wrap(other))
+
+  def div(other) = LazyVec.new(:div, self, LazyVec.wrap(other))
+
+  alias + add
+  alias - sub
+  alias * mul
+  alias / div
+
+  def lazy() = self
+
+  def self.wrap(value)
+    value.is_a?(LazyVec) ? value : LazyVec.new(:leaf, value)
+  end
+
+  def leaf?() = @op == :leaf
+
+  def value
+    counts = {}
+    __count(counts)
+
+    size = __size(nil)
+    memo = {}
+
+    if size.nil?
+      res = __eval(nil, counts, memo)
+      return __owned?(counts) ? res : res.dup
+    end
+
+    Array.new(size) do |i|
+      memo.clear
+      res = __eval(i, counts, memo)
+      __owned?(counts) ? res : res.dup
+    end
+  end
+
+  alias force value
+
+  def to_s() = leaf? ? "lazy(#{@lhs})" : "(#{@lhs} #{@op} #{@rhs})"
+
+  alias inspect to_s
+
+  def __count(counts)
+    seen = counts.key?(self)
+    counts[self] = (counts[self] || 0) + 1
+    return if seen || leaf?
+
+    @lhs.__count(counts)
+    @rhs.__count(counts)
+  end
+
+  def __size(size)
+    if leaf?
+      return size unless @lhs.is_a?(Array)
+      if size && size != @lhs.size
+        raise ArgumentError, "collection size mismatch (#{@lhs.size} for #{size})"
+      end
+
+      return @lhs.size
+    end
+
+    @rhs.__size(@lhs.__size(size))
+  end
+
+  # Results of non-leaf nodes referenced once may be mutated by their parent;
+  # leaves and shared nodes must be copied first.
+  def __owned?(counts) = !leaf? && counts[self] == 1
+
+  def __eval(i, counts, memo)
+    if leaf?
+      return i && @lhs.is_a?(Array) ? @lhs[i] : @lhs
+    end
+
+    shared = counts[self] > 1
+    return memo[self] if shared && memo.key?(self)
+
+    acc = @lhs.__eval(i, counts, memo)
+    acc = acc.dup unless @lhs.__owned?(counts)
+    if @op == :add && @rhs.op == :mul && counts[@rhs] == 1
+      # a + b * s needs no temporary for b * s
+      acc.madd!(@rhs.lhs.__eval(i, counts, memo),
+                @rhs.rhs.__eval(i, counts, memo))
+    else
+      acc.__send__(OPS[@op], @rhs.__eval(i, counts, memo))
+    end
+
+    memo[self] = acc if shared
+    acc
+  end
+end
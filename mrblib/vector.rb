@@ -1,4 +1,8 @@
 class Vec2
+  def self.lazy(value) = LazyVec.wrap(value)
+
+  def lazy() = LazyVec.wrap(self)
+
   def to_s() = "Vec2[#{x}, #{y}]"
 
   def to_a() = [x, y]
@@ -13,6 +17,10 @@ class Vec2
 end
 
 class Vec3
+  def self.lazy(value) = LazyVec.wrap(value)
+
+  def lazy() = LazyVec.wrap(self)
+
   def to_s() = "Vec3[#{x}, #{y}, #{z}]"
 
   def to_a() = [x, y, z]
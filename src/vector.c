@@ -40,6 +40,19 @@ static mrb_value mrb_vec3_wrap(mrb_state *mrb, struct RClass *vc, vec3 *vec) {
   return mrb_obj_value(Data_Wrap_Struct(mrb, vc, &mrb_vec3_type, vec));
 }
 
+// use the libm fma only where it is a single instruction; the software
+// fallback is far slower than a plain multiply-add
+#ifdef MRB_USE_FLOAT32
+#ifdef FP_FAST_FMAF
+#define vec_fma(a, b, c) fmaf(a, b, c)
+#endif
+#elif defined(FP_FAST_FMA)
+#define vec_fma(a, b, c) fma(a, b, c)
+#endif
+#ifndef vec_fma
+#define vec_fma(a, b, c) ((a) * (b) + (c))
+#endif
+
 #define vec2_unwrap(self) ((vec2 *)DATA_PTR(self))
 
 #define vec3_unwrap(self) ((vec3 *)DATA_PTR(self))
@@ -410,6 +423,123 @@ mrb_value mrb_vec2_div_b(mrb_state *mrb, mrb_value self) {
   return self;
 }
 
+static void vec2_get_operand(mrb_state *mrb, mrb_value self, mrb_value arg,
+                             vec2 *out) {
+  if (mrb_obj_is_kind_of(mrb, arg, clss.numeric)) {
+    mrb_float other = mrb_as_float(mrb, arg);
+    out->x = other;
+    out->y = other;
+  } else if (mrb_obj_is_kind_of(mrb, arg, mrb_obj_class(mrb, self))) {
+    *out = *vec2_unwrap(arg);
+  } else {
+    mrb_raisef(mrb, E_TYPE_ERROR, "%C is neither a `Numeric` nor a `Vec2`",
+               mrb_obj_class(mrb, arg));
+  }
+}
+
+// dst = a * b + c, component-wise
+static void vec2_fma(vec2 *dst, const vec2 *a, const vec2 *b, const vec2 *c) {
+  dst->x = vec_fma(a->x, b->x, c->x);
+  dst->y = vec_fma(a->y, b->y, c->y);
+}
+
+static mrb_value vec2_fused(mrb_state *mrb, mrb_value self, mrb_value dst,
+                            const vec2 *a, const vec2 *b, const vec2 *c) {
+  if (mrb_nil_p(dst)) {
+    vec2 *new = vec2_init(mrb, 0, 0);
+    dst = mrb_vec2_wrap(mrb, mrb_obj_class(mrb, self), new);
+  }
+
+  vec2_fma(vec2_unwrap(dst), a, b, c);
+  return dst;
+}
+
+// self + b * s
+static mrb_value vec2_madd(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value arg;
+  mrb_float s;
+  vec2 b, sv;
+
+  mrb_get_args(mrb, "of", &arg, &s);
+  vec2_get_operand(mrb, self, arg, &b);
+  sv.x = sv.y = s;
+
+  return vec2_fused(mrb, self, dst, &b, &sv, vec2_unwrap(self));
+}
+
+mrb_value mrb_vec2_madd(mrb_state *mrb, mrb_value self) {
+  return vec2_madd(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec2_madd_b(mrb_state *mrb, mrb_value self) {
+  return vec2_madd(mrb, self, self);
+}
+
+// self + a * x
+static mrb_value vec2_axpy(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_float a;
+  mrb_value arg;
+  vec2 av, x;
+
+  mrb_get_args(mrb, "fo", &a, &arg);
+  vec2_get_operand(mrb, self, arg, &x);
+  av.x = av.y = a;
+
+  return vec2_fused(mrb, self, dst, &av, &x, vec2_unwrap(self));
+}
+
+mrb_value mrb_vec2_axpy(mrb_state *mrb, mrb_value self) {
+  return vec2_axpy(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec2_axpy_b(mrb_state *mrb, mrb_value self) {
+  return vec2_axpy(mrb, self, self);
+}
+
+// self + (b - self) * t
+static mrb_value vec2_lerp(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value arg;
+  mrb_float t;
+  vec2 b, tv;
+  vec2 *vec = vec2_unwrap(self);
+
+  mrb_get_args(mrb, "of", &arg, &t);
+  vec2_get_operand(mrb, self, arg, &b);
+  b.x -= vec->x;
+  b.y -= vec->y;
+  tv.x = tv.y = t;
+
+  return vec2_fused(mrb, self, dst, &b, &tv, vec);
+}
+
+mrb_value mrb_vec2_lerp(mrb_state *mrb, mrb_value self) {
+  return vec2_lerp(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec2_lerp_b(mrb_state *mrb, mrb_value self) {
+  return vec2_lerp(mrb, self, self);
+}
+
+// self * b + c
+static mrb_value vec2_fma_m(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value barg, carg;
+  vec2 b, c;
+
+  mrb_get_args(mrb, "oo", &barg, &carg);
+  vec2_get_operand(mrb, self, barg, &b);
+  vec2_get_operand(mrb, self, carg, &c);
+
+  return vec2_fused(mrb, self, dst, vec2_unwrap(self), &b, &c);
+}
+
+mrb_value mrb_vec2_fma(mrb_state *mrb, mrb_value self) {
+  return vec2_fma_m(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec2_fma_b(mrb_state *mrb, mrb_value self) {
+  return vec2_fma_m(mrb, self, self);
+}
+
 mrb_value mrb_vec2_to_v2(mrb_state *mrb, mrb_value self) { return self; }
 
 mrb_value mrb_vec2_to_v3(mrb_state *mrb, mrb_value self) {
@@ -594,6 +724,126 @@ mrb_value mrb_vec3_div_b(mrb_state *mrb, mrb_value self) {
   return self;
 }
 
+static void vec3_get_operand(mrb_state *mrb, mrb_value self, mrb_value arg,
+                             vec3 *out) {
+  if (mrb_obj_is_kind_of(mrb, arg, clss.numeric)) {
+    mrb_float other = mrb_as_float(mrb, arg);
+    out->x = other;
+    out->y = other;
+    out->z = other;
+  } else if (mrb_obj_is_kind_of(mrb, arg, mrb_obj_class(mrb, self))) {
+    *out = *vec3_unwrap(arg);
+  } else {
+    mrb_raisef(mrb, E_TYPE_ERROR, "%C is neither a `Numeric` nor a `Vec3`",
+               mrb_obj_class(mrb, arg));
+  }
+}
+
+// dst = a * b + c, component-wise
+static void vec3_fma(vec3 *dst, const vec3 *a, const vec3 *b, const vec3 *c) {
+  dst->x = vec_fma(a->x, b->x, c->x);
+  dst->y = vec_fma(a->y, b->y, c->y);
+  dst->z = vec_fma(a->z, b->z, c->z);
+}
+
+static mrb_value vec3_fused(mrb_state *mrb, mrb_value self, mrb_value dst,
+                            const vec3 *a, const vec3 *b, const vec3 *c) {
+  if (mrb_nil_p(dst)) {
+    vec3 *new = vec3_init(mrb, 0, 0, 0);
+    dst = mrb_vec3_wrap(mrb, mrb_obj_class(mrb, self), new);
+  }
+
+  vec3_fma(vec3_unwrap(dst), a, b, c);
+  return dst;
+}
+
+// self + b * s
+static mrb_value vec3_madd(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value arg;
+  mrb_float s;
+  vec3 b, sv;
+
+  mrb_get_args(mrb, "of", &arg, &s);
+  vec3_get_operand(mrb, self, arg, &b);
+  sv.x = sv.y = sv.z = s;
+
+  return vec3_fused(mrb, self, dst, &b, &sv, vec3_unwrap(self));
+}
+
+mrb_value mrb_vec3_madd(mrb_state *mrb, mrb_value self) {
+  return vec3_madd(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec3_madd_b(mrb_state *mrb, mrb_value self) {
+  return vec3_madd(mrb, self, self);
+}
+
+// self + a * x
+static mrb_value vec3_axpy(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_float a;
+  mrb_value arg;
+  vec3 av, x;
+
+  mrb_get_args(mrb, "fo", &a, &arg);
+  vec3_get_operand(mrb, self, arg, &x);
+  av.x = av.y = av.z = a;
+
+  return vec3_fused(mrb, self, dst, &av, &x, vec3_unwrap(self));
+}
+
+mrb_value mrb_vec3_axpy(mrb_state *mrb, mrb_value self) {
+  return vec3_axpy(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec3_axpy_b(mrb_state *mrb, mrb_value self) {
+  return vec3_axpy(mrb, self, self);
+}
+
+// self + (b - self) * t
+static mrb_value vec3_lerp(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value arg;
+  mrb_float t;
+  vec3 b, tv;
+  vec3 *vec = vec3_unwrap(self);
+
+  mrb_get_args(mrb, "of", &arg, &t);
+  vec3_get_operand(mrb, self, arg, &b);
+  b.x -= vec->x;
+  b.y -= vec->y;
+  b.z -= vec->z;
+  tv.x = tv.y = tv.z = t;
+
+  return vec3_fused(mrb, self, dst, &b, &tv, vec);
+}
+
+mrb_value mrb_vec3_lerp(mrb_state *mrb, mrb_value self) {
+  return vec3_lerp(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec3_lerp_b(mrb_state *mrb, mrb_value self) {
+  return vec3_lerp(mrb, self, self);
+}
+
+// self * b + c
+static mrb_value vec3_fma_m(mrb_state *mrb, mrb_value self, mrb_value dst) {
+  mrb_value barg, carg;
+  vec3 b, c;
+
+  mrb_get_args(mrb, "oo", &barg, &carg);
+  vec3_get_operand(mrb, self, barg, &b);
+  vec3_get_operand(mrb, self, carg, &c);
+
+  return vec3_fused(mrb, self, dst, vec3_unwrap(self), &b, &c);
+}
+
+mrb_value mrb_vec3_fma(mrb_state *mrb, mrb_value self) {
+  return vec3_fma_m(mrb, self, mrb_nil_value());
+}
+
+mrb_value mrb_vec3_fma_b(mrb_state *mrb, mrb_value self) {
+  return vec3_fma_m(mrb, self, self);
+}
+
 mrb_value mrb_vec3_to_v2(mrb_state *mrb, mrb_value self) {
   vec3 *vec = vec3_unwrap(self);
 
@@ -633,6 +883,14 @@ void mrb_mruby_vector_gem_init(mrb_state *mrb) {
   mrb_define_method(mrb, vec2_c, "mul!", mrb_vec2_mul_b, MRB_ARGS_REQ(1));
   mrb_define_method(mrb, vec2_c, "div", mrb_vec2_div, MRB_ARGS_REQ(1));
   mrb_define_method(mrb, vec2_c, "div!", mrb_vec2_div_b, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, vec2_c, "madd", mrb_vec2_madd, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "madd!", mrb_vec2_madd_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "axpy", mrb_vec2_axpy, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "axpy!", mrb_vec2_axpy_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "lerp", mrb_vec2_lerp, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "lerp!", mrb_vec2_lerp_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "fma", mrb_vec2_fma, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec2_c, "fma!", mrb_vec2_fma_b, MRB_ARGS_REQ(2));
   mrb_define_method(mrb, vec2_c, "to_v2", mrb_vec2_to_v2, MRB_ARGS_NONE());
   mrb_define_method(mrb, vec2_c, "to_v3", mrb_vec2_to_v3, MRB_ARGS_NONE());
   mrb_define_method(mrb, vec2_c, "sq_mag", mrb_vec2_sq_mag, MRB_ARGS_NONE());
@@ -664,6 +922,14 @@ void mrb_mruby_vector_gem_init(mrb_state *mrb) {
   mrb_define_method(mrb, vec3_c, "mul!", mrb_vec3_mul_b, MRB_ARGS_REQ(1));
   mrb_define_method(mrb, vec3_c, "div", mrb_vec3_div, MRB_ARGS_REQ(1));
   mrb_define_method(mrb, vec3_c, "div!", mrb_vec3_div_b, MRB_ARGS_REQ(1));
+  mrb_define_method(mrb, vec3_c, "madd", mrb_vec3_madd, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "madd!", mrb_vec3_madd_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "axpy", mrb_vec3_axpy, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "axpy!", mrb_vec3_axpy_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "lerp", mrb_vec3_lerp, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "lerp!", mrb_vec3_lerp_b, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "fma", mrb_vec3_fma, MRB_ARGS_REQ(2));
+  mrb_define_method(mrb, vec3_c, "fma!", mrb_vec3_fma_b, MRB_ARGS_REQ(2));
   mrb_define_method(mrb, vec3_c, "to_v2", mrb_vec3_to_v2, MRB_ARGS_NONE());
   mrb_define_method(mrb, vec3_c, "to_v3", mrb_vec3_to_v3, MRB_ARGS_NONE());
   mrb_define_method(mrb, vec3_c, "sq_mag", mrb_vec3_sq_mag, MRB_ARGS_NONE());